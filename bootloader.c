@@ -43,6 +43,8 @@ void SetImageStatusFlag(bl_image_status_t status)
 
 		// modify the segment with new status
 		*(seg_copy_ptr + BL_IMAGE_STATUS_FLAG_OFFSET) = status;
+		// new status, start with a fresh boot attempts budget; the image pending validation boots right away so its first attempt is used up in the same write
+		*(seg_copy_ptr + BL_IMAGE_BOOT_ATTEMPTS_OFFSET) = (status == BL_IMAGE_PENDING_VALIDATION) ? 0xFE : 0xFF;
 
 		// erase info segment
 		FlashErase(BL_IMAGE_INFO_SEG_ADDR, ERASE);
@@ -76,6 +78,45 @@ bl_image_status_t GetImageStatusFlag()
 	return status;
 }
 
+// Counts a boot of the image pending validation by clearing the next bit of the counter.
+// Bits are only cleared so the info segment does not need to be erased on every boot.
+// Programming never sets bits back to 1, so the counter cannot go backwards without an erase. An interrupted write
+// may leave the target bit at 1, which delays the recovery by at most one boot but never skips it.
+void IncBootAttempts()
+{
+	uint8_t counter = flashReadByte(BL_IMAGE_INFO_SEG_ADDR + BL_IMAGE_BOOT_ATTEMPTS_OFFSET);
+
+	if (counter == 0)												// all bits already cleared
+		return;
+
+	FCTL3 = FWKEY;													// Clear Lock bit
+	FCTL1 = FWKEY + WRT;											// Enable byte/word write mode
+
+	while (FCTL3 & BUSY) ;											// test busy
+
+	flashWriteByte(BL_IMAGE_INFO_SEG_ADDR + BL_IMAGE_BOOT_ATTEMPTS_OFFSET, counter & (counter - 1));	// clear the lowest set bit
+
+	while (FCTL3 & BUSY) ;											// test busy
+
+	FCTL1 = FWKEY;													// Clear WRT bit
+	FCTL3 = FWKEY + LOCK;											// Set LOCK bit
+}
+
+// Returns the number of cleared bits of the counter, i.e. the boots already used by the image pending validation.
+uint8_t GetBootAttempts()
+{
+	uint8_t attempts = 0;
+	uint8_t bits = (uint8_t)~flashReadByte(BL_IMAGE_INFO_SEG_ADDR + BL_IMAGE_BOOT_ATTEMPTS_OFFSET);
+
+	while (bits)													// count cleared bits
+	{
+		attempts += bits & 1;
+		bits >>= 1;
+	}
+
+	return attempts;
+}
+
 bool reflash()
 {
 	uint32_t flash_addr, data_addr;
@@ -417,7 +458,13 @@ int main()
 			}
 			break;
 
-		case BL_IMAGE_PENDING_VALIDATION:												// image not validated by the application, recover image from backup
+		case BL_IMAGE_PENDING_VALIDATION:												// image not validated by the application, recover image from backup once its boot attempts are used up
+			if (GetBootAttempts() < BL_IMAGE_BOOT_ATTEMPTS_MAX)
+			{
+				IncBootAttempts();														// give the image another boot, e.g. after a brown-out
+				break;
+			}
+
 			P1OUT |= BIT0;
 			P4OUT |= BIT7;
 
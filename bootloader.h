@@ -33,6 +33,15 @@
 
 #define BL_IMAGE_INFO_SEG_ADDR			0x1900
 #define BL_IMAGE_STATUS_FLAG_OFFSET		0							// image status flag is stored at address: BL_IMAGE_STATUS_FLAG_SEG_ADDR + BL_IMAGE_STATUS_FLAG_OFFSET
+#define BL_IMAGE_BOOT_ATTEMPTS_OFFSET	1							// boot attempts counter of the image pending validation, one bit cleared per boot (0xFF = no boots yet); this byte belongs to the bootloader, the application must not use it
+
+#ifndef BL_IMAGE_BOOT_ATTEMPTS_MAX
+#define BL_IMAGE_BOOT_ATTEMPTS_MAX		3							// number of boots given to the image pending validation before it is recovered from backup (1..8)
+#endif
+
+#if (BL_IMAGE_BOOT_ATTEMPTS_MAX < 1) || (BL_IMAGE_BOOT_ATTEMPTS_MAX > 8)
+#error "BL_IMAGE_BOOT_ATTEMPTS_MAX must be within 1..8"
+#endif
 
 #define APP_RESET_VECTOR_ADDR			0xFF7E						// application reset vector to be stored here instead of 0xFFFE (0xFFFE is reserved for bootloader's reset vector)
 #define IMAGE_APP_SIZE					32640						// bytes of the application without reset vector
@@ -53,6 +62,8 @@ typedef enum {
 
 void SetImageStatusFlag(bl_image_status_t status);
 bl_image_status_t GetImageStatusFlag();
+void IncBootAttempts();
+uint8_t GetBootAttempts();
 void McuReset();
 
 #endif /* BOOTLOADER_H_ */